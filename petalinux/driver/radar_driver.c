@@ -9,6 +9,7 @@
 #include <linux/wait.h>
 #include <linux/sched.h>
 #include <linux/poll.h>
+#include <linux/slab.h>
 
 #define DRIVER_NAME "pulse_radar_ip"
 #define RADAR_REG_SIZE 0x10000
@@ -23,6 +24,7 @@
 #define RADAR_DETECTED_RANGE_REG 0x18
 #define RADAR_DETECTED_VELOCITY_REG 0x1C
 #define RADAR_THRESHOLD_REG   0x20
+#define RADAR_WINDOW_COEFF_REG 0x30
 
 // Control register bits
 #define RADAR_ENABLE_BIT      0x01
@@ -37,6 +39,15 @@
 #define RADAR_TARGET_DETECTED_BIT 0x04
 #define RADAR_ERROR_BIT       0x08
 
+// Window coefficient tables (symmetric, only half of each window is stored)
+#define RADAR_WINDOW_RANGE    0
+#define RADAR_WINDOW_DOPPLER  1
+#define RADAR_RANGE_WINDOW_COEFFS   512  // 1024-point range FFT
+#define RADAR_DOPPLER_WINDOW_COEFFS 32   // 64-point Doppler FFT
+#define RADAR_WINDOW_MAX_COEFFS     RADAR_RANGE_WINDOW_COEFFS
+#define RADAR_WINDOW_COEFF_MAX      0x7FFF // Q1.15, 1.0
+#define RADAR_WINDOW_SEL_DOPPLER    0x80000000
+
 // IOCTL commands
 #define RADAR_IOC_MAGIC 'R'
 #define RADAR_IOC_START         _IO(RADAR_IOC_MAGIC, 0)
@@ -46,6 +57,7 @@
 #define RADAR_IOC_SET_THRESHOLD _IOW(RADAR_IOC_MAGIC, 4, uint32_t)
 #define RADAR_IOC_GET_STATUS    _IOR(RADAR_IOC_MAGIC, 5, uint32_t)
 #define RADAR_IOC_GET_TARGET    _IOR(RADAR_IOC_MAGIC, 6, struct radar_target)
+#define RADAR_IOC_SET_WINDOW    _IOW(RADAR_IOC_MAGIC, 7, struct radar_window)
 
 struct radar_target {
     uint16_t range;      // Range in meters
@@ -54,6 +66,12 @@ struct radar_target {
     uint16_t doppler_bin; // Doppler bin number
 };
 
+struct radar_window {
+    uint32_t table;      // RADAR_WINDOW_RANGE or RADAR_WINDOW_DOPPLER
+    uint32_t count;      // Number of coefficients (half of window size)
+    uint16_t coeffs[RADAR_WINDOW_MAX_COEFFS]; // Unsigned Q1.15
+};
+
 struct radar_device {
     void __iomem *base;
     struct cdev cdev;
@@ -104,6 +122,73 @@ static irqreturn_t radar_processing_complete_irq(int irq, void *dev_id)
     return IRQ_HANDLED;
 }
 
+// Upload the first half of a symmetric window into the IP coefficient table
+static int radar_set_window(struct radar_device *rdev, struct radar_window __user *uwin)
+{
+    struct radar_window *win;
+    uint32_t expected;
+    uint32_t sel;
+    uint32_t i;
+    int ret = 0;
+    
+    win = memdup_user(uwin, sizeof(*win));
+    if (IS_ERR(win))
+        return PTR_ERR(win);
+    
+    switch (win->table) {
+    case RADAR_WINDOW_RANGE:
+        expected = RADAR_RANGE_WINDOW_COEFFS;
+        sel = 0;
+        break;
+    case RADAR_WINDOW_DOPPLER:
+        expected = RADAR_DOPPLER_WINDOW_COEFFS;
+        sel = RADAR_WINDOW_SEL_DOPPLER;
+        break;
+    default:
+        dev_err(rdev->dev, "Invalid window table %u\n", win->table);
+        ret = -EINVAL;
+        goto out;
+    }
+    
+    if (win->count != expected) {
+        dev_err(rdev->dev, "Window table needs %u coefficients, got %u\n",
+                expected, win->count);
+        ret = -EINVAL;
+        goto out;
+    }
+    
+    for (i = 0; i < win->count; i++) {
+        if (win->coeffs[i] > RADAR_WINDOW_COEFF_MAX) {
+            dev_err(rdev->dev, "Window coefficient %u out of range (0x%04x)\n",
+                    i, win->coeffs[i]);
+            ret = -EINVAL;
+            goto out;
+        }
+    }
+    
+    // The table is live, so refuse to change it while frames are processed
+    mutex_lock(&rdev->mutex);
+    if (ioread32(rdev->base + RADAR_CONTROL_REG) &
+        (RADAR_RANGE_PROC_BIT | RADAR_DOPPLER_PROC_BIT)) {
+        mutex_unlock(&rdev->mutex);
+        dev_err(rdev->dev, "Stop the radar before loading a window\n");
+        ret = -EBUSY;
+        goto out;
+    }
+    
+    // Each write carries {table select, index, coefficient}
+    for (i = 0; i < win->count; i++)
+        iowrite32(sel | (i << 16) | win->coeffs[i], rdev->base + RADAR_WINDOW_COEFF_REG);
+    mutex_unlock(&rdev->mutex);
+    
+    dev_info(rdev->dev, "%s window loaded (%u coefficients)\n",
+             win->table == RADAR_WINDOW_RANGE ? "Range" : "Doppler", win->count);
+    
+out:
+    kfree(win);
+    return ret;
+}
+
 // File operations
 static int radar_open(struct inode *inode, struct file *file)
 {
@@ -229,6 +314,10 @@ static long radar_ioctl(struct file *file, unsigned int cmd, unsigned long arg)
         mutex_unlock(&rdev->mutex);
         break;
         
+    case RADAR_IOC_SET_WINDOW:
+        ret = radar_set_window(rdev, (struct radar_window __user *)arg);
+        break;
+        
     default:
         return -ENOTTY;
     }
@@ -35,6 +35,23 @@ radar_app -p 2000 -w 10 -t 100 -s
 
 echo "✓ Radar test completed"
 
+# Test window coefficient upload
+# (radar_app stops the radar on exit, uploads are rejected while it runs)
+echo "Testing window coefficient upload..."
+if ! command -v radar_window > /dev/null; then
+    echo "ERROR: radar_window not installed"
+    exit 1
+fi
+
+for args in "-w hann" "-w hann -d" "-w hamming" "-w hamming -d"; do
+    if ! radar_window $args -u; then
+        echo "ERROR: Window upload failed (radar_window $args -u)"
+        exit 1
+    fi
+done
+
+echo "✓ Window upload completed"
+
 # Test target detection (simulation)
 echo "Testing target detection (10 seconds)..."
 timeout 10 radar_app -m
@@ -0,0 +1,207 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <sys/ioctl.h>
+#include <string.h>
+#include <math.h>
+
+#define RADAR_IOC_MAGIC 'R'
+#define RADAR_IOC_SET_WINDOW    _IOW(RADAR_IOC_MAGIC, 7, struct radar_window)
+
+#define RADAR_WINDOW_RANGE    0
+#define RADAR_WINDOW_DOPPLER  1
+#define RADAR_RANGE_SIZE      1024
+#define RADAR_DOPPLER_SIZE    64
+#define RADAR_WINDOW_MAX_COEFFS (RADAR_RANGE_SIZE / 2)
+#define RADAR_WINDOW_COEFF_MAX  0x7FFF // Q1.15, 1.0
+
+struct radar_window {
+    uint32_t table;      // RADAR_WINDOW_RANGE or RADAR_WINDOW_DOPPLER
+    uint32_t count;      // Number of coefficients (half of window size)
+    uint16_t coeffs[RADAR_WINDOW_MAX_COEFFS]; // Unsigned Q1.15
+};
+
+enum window_type {
+    WINDOW_HAMMING,
+    WINDOW_HANN,
+    WINDOW_BLACKMAN_HARRIS,
+    WINDOW_TAYLOR,
+};
+
+void print_usage(const char *prog_name) {
+    printf("Usage: %s [options]\n", prog_name);
+    printf("Options:\n");
+    printf("  -w <type>    Window type: hamming, hann, blackman-harris, taylor\n");
+    printf("  -d           Doppler table (%d-point) instead of range (%d-point)\n",
+           RADAR_DOPPLER_SIZE, RADAR_RANGE_SIZE);
+    printf("  -n <nbar>    Taylor: number of nearly constant sidelobes (default 4)\n");
+    printf("  -l <sll>     Taylor: peak sidelobe level in dB (default 30)\n");
+    printf("  -o <file>    Write table as $readmemh hex file\n");
+    printf("  -u           Upload table to radar device\n");
+    printf("  -h           Show this help\n");
+}
+
+// Taylor window, normalized to 1.0 at the center (Carrara/Doerry form)
+static double taylor_coeff(int i, int size, int nbar, double sll) {
+    double a = acosh(pow(10.0, sll / 20.0)) / M_PI;
+    double sp2 = (double)(nbar * nbar) / (a * a + (nbar - 0.5) * (nbar - 0.5));
+    double x = (i - size / 2.0 + 0.5) / size;
+    double w = 1.0;
+    double peak = 1.0;
+
+    for (int m = 1; m < nbar; m++) {
+        double numer = (m % 2) ? 1.0 : -1.0;
+        double denom = 2.0;
+
+        for (int n = 1; n < nbar; n++) {
+            numer *= 1.0 - (double)(m * m) / sp2 / (a * a + (n - 0.5) * (n - 0.5));
+            if (n != m)
+                denom *= 1.0 - (double)(m * m) / (n * n);
+        }
+
+        w += 2.0 * (numer / denom) * cos(2.0 * M_PI * m * x);
+        peak += 2.0 * (numer / denom);
+    }
+
+    return w / peak;
+}
+
+static double window_coeff(enum window_type type, int i, int size, int nbar, double sll) {
+    double phase = 2.0 * M_PI * i / (size - 1);
+
+    switch (type) {
+    case WINDOW_HANN:
+        return 0.5 - 0.5 * cos(phase);
+    case WINDOW_BLACKMAN_HARRIS:
+        return 0.35875 - 0.48829 * cos(phase) + 0.14128 * cos(2.0 * phase)
+               - 0.01168 * cos(3.0 * phase);
+    case WINDOW_TAYLOR:
+        return taylor_coeff(i, size, nbar, sll);
+    case WINDOW_HAMMING:
+    default:
+        return 0.54 - 0.46 * cos(phase);
+    }
+}
+
+// Quantize to the IP's unsigned Q1.15 coefficient format, rounding the same
+// way as the power-on table in hamming_window.sv ($rtoi(w * 32767.0 + 0.5))
+static uint16_t quantize(double w) {
+    double q = w * RADAR_WINDOW_COEFF_MAX + 0.5;
+
+    if (q < 0.0)
+        return 0;
+    if (q > RADAR_WINDOW_COEFF_MAX)
+        return RADAR_WINDOW_COEFF_MAX;
+    return (uint16_t)q;
+}
+
+int main(int argc, char *argv[]) {
+    int fd;
+    int ret;
+    int opt;
+    int size = RADAR_RANGE_SIZE;
+    int nbar = 4;
+    double sll = 30.0;
+    bool upload = false;
+    const char *output_file = NULL;
+    enum window_type type = WINDOW_HAMMING;
+    struct radar_window win;
+    FILE *fp;
+
+    memset(&win, 0, sizeof(win));
+    win.table = RADAR_WINDOW_RANGE;
+
+    // Parse command line arguments
+    while ((opt = getopt(argc, argv, "w:dn:l:o:uh")) != -1) {
+        switch (opt) {
+        case 'w':
+            if (strcmp(optarg, "hamming") == 0) {
+                type = WINDOW_HAMMING;
+            } else if (strcmp(optarg, "hann") == 0) {
+                type = WINDOW_HANN;
+            } else if (strcmp(optarg, "blackman-harris") == 0) {
+                type = WINDOW_BLACKMAN_HARRIS;
+            } else if (strcmp(optarg, "taylor") == 0) {
+                type = WINDOW_TAYLOR;
+            } else {
+                fprintf(stderr, "Unknown window type: %s\n", optarg);
+                return 1;
+            }
+            break;
+        case 'd':
+            win.table = RADAR_WINDOW_DOPPLER;
+            size = RADAR_DOPPLER_SIZE;
+            break;
+        case 'n':
+            nbar = atoi(optarg);
+            if (nbar < 1 || nbar > 10) {
+                fprintf(stderr, "Taylor nbar must be between 1-10\n");
+                return 1;
+            }
+            break;
+        case 'l':
+            sll = atof(optarg);
+            if (sll < 13.0 || sll > 100.0) {
+                fprintf(stderr, "Taylor sidelobe level must be between 13-100 dB\n");
+                return 1;
+            }
+            break;
+        case 'o':
+            output_file = optarg;
+            break;
+        case 'u':
+            upload = true;
+            break;
+        case 'h':
+            print_usage(argv[0]);
+            return 0;
+        default:
+            print_usage(argv[0]);
+            return 1;
+        }
+    }
+
+    if (!upload && !output_file) {
+        print_usage(argv[0]);
+        return 1;
+    }
+
+    // Only the first half is generated, the IP mirrors the second half
+    win.count = (size + 1) / 2;
+    for (uint32_t i = 0; i < win.count; i++)
+        win.coeffs[i] = quantize(window_coeff(type, i, size, nbar, sll));
+
+    if (output_file) {
+        fp = fopen(output_file, "w");
+        if (!fp) {
+            perror("Failed to open output file");
+            return 1;
+        }
+        for (uint32_t i = 0; i < win.count; i++)
+            fprintf(fp, "%04x\n", win.coeffs[i]);
+        fclose(fp);
+        printf("Wrote %u coefficients to %s\n", win.count, output_file);
+    }
+
+    if (upload) {
+        fd = open("/dev/pulse_radar_ip", O_RDWR);
+        if (fd < 0) {
+            perror("Failed to open radar device");
+            return 1;
+        }
+
+        ret = ioctl(fd, RADAR_IOC_SET_WINDOW, &win);
+        close(fd);
+        if (ret < 0) {
+            perror("Failed to upload window");
+            return 1;
+        }
+        printf("%s window uploaded (%d-point)\n",
+               win.table == RADAR_WINDOW_RANGE ? "Range" : "Doppler", size);
+    }
+
+    return 0;
+}
@@ -1,6 +1,7 @@
 module doppler_processor #(
     parameter DATA_WIDTH = 16,
-    parameter DOPPLER_SIZE = 64
+    parameter DOPPLER_SIZE = 64,
+    parameter WINDOW_INIT = ""
 )(
     input wire clk,
     input wire rst_n,
@@ -8,6 +9,9 @@ module doppler_processor #(
     input wire [DATA_WIDTH-1:0] data_in,
     input wire data_valid,
     input wire [31:0] doppler_bins,
+    input wire window_wr_en,
+    input wire [14:0] window_wr_addr,
+    input wire [15:0] window_wr_data,
     output wire [DATA_WIDTH-1:0] processed_data,
     output wire processed_valid
 );
@@ -42,15 +46,19 @@ always @(posedge clk or negedge rst_n) begin
     end
 end
 
-// Doppler windowing (Hamming window)
+// Doppler windowing (Hamming by default, reloadable over AXI-Lite)
 hamming_window #(
     .DATA_WIDTH(DATA_WIDTH),
-    .WINDOW_SIZE(DOPPLER_SIZE)
+    .WINDOW_SIZE(DOPPLER_SIZE),
+    .INIT_FILE(WINDOW_INIT)
 ) u_doppler_window (
     .clk(clk),
     .rst_n(rst_n),
     .data_in(pulse_buffer[pulse_count]),
     .data_valid(buffer_full),
+    .coeff_wr_en(window_wr_en),
+    .coeff_wr_addr(window_wr_addr),
+    .coeff_wr_data(window_wr_data),
     .data_out(windowed_doppler_data),
     .data_out_valid(windowed_doppler_valid)
 );
@@ -1,29 +1,55 @@
 module hamming_window #(
     parameter DATA_WIDTH = 16,
-    parameter WINDOW_SIZE = 1024
+    parameter WINDOW_SIZE = 1024,
+    parameter INIT_FILE = ""
 )(
     input wire clk,
     input wire rst_n,
     input wire [DATA_WIDTH-1:0] data_in,
     input wire data_valid,
+    // Coefficient write port (from AXI-Lite WINDOW_COEFF register)
+    input wire coeff_wr_en,
+    input wire [14:0] coeff_wr_addr,
+    input wire [15:0] coeff_wr_data,
     output wire [DATA_WIDTH-1:0] data_out,
     output wire data_out_valid
 );
 
-// Pre-computed Hamming window coefficients (stored in ROM)
-reg [DATA_WIDTH-1:0] window_coeff [0:WINDOW_SIZE-1];
+// Window functions are symmetric (w[i] == w[N-1-i]), so only the first
+// half of the table is stored and the second half is read mirrored.
+localparam HALF_SIZE = (WINDOW_SIZE + 1) / 2;
+
+// Window coefficients, unsigned Q1.15 (32767 = 1.0) for any DATA_WIDTH,
+// reloadable at runtime
+reg [15:0] window_coeff [0:HALF_SIZE-1];
 reg [$clog2(WINDOW_SIZE)-1:0] window_index;
-reg [DATA_WIDTH*2-1:0] multiplied_result;
+wire [$clog2(WINDOW_SIZE)-1:0] coeff_index;
+reg [DATA_WIDTH+15:0] multiplied_result;
 reg result_valid;
 
-// Initialize Hamming window coefficients
+// Initialize with Hamming window coefficients unless a table file is given
 initial begin
-    for (int i = 0; i < WINDOW_SIZE; i++) begin
-        // Hamming window: 0.54 - 0.46 * cos(2*pi*i/(N-1))
-        window_coeff[i] = $rtoi((0.54 - 0.46 * $cos(2.0 * 3.14159 * i / (WINDOW_SIZE - 1))) * ((2**(DATA_WIDTH-1)) - 1));
+    if (INIT_FILE != "") begin
+        $readmemh(INIT_FILE, window_coeff);
+    end else begin
+        for (int i = 0; i < HALF_SIZE; i++) begin
+            // Hamming window: 0.54 - 0.46 * cos(2*pi*i/(N-1)), rounded to Q1.15
+            // (must match the quantization in user_app/radar_window.c)
+            window_coeff[i] = $rtoi((0.54 - 0.46 * $cos(2.0 * 3.141592653589793 * i / (WINDOW_SIZE - 1))) * 32767.0 + 0.5);
+        end
+    end
+end
+
+// Coefficient upload; out-of-range addresses are ignored
+always @(posedge clk) begin
+    if (coeff_wr_en && coeff_wr_addr < HALF_SIZE) begin
+        window_coeff[coeff_wr_addr] <= coeff_wr_data;
     end
 end
 
+// Mirror the index for the second half of the window
+assign coeff_index = (window_index < HALF_SIZE) ? window_index : (WINDOW_SIZE - 1 - window_index);
+
 always @(posedge clk or negedge rst_n) begin
     if (!rst_n) begin
         window_index <= 0;
@@ -31,9 +57,9 @@ always @(posedge clk or negedge rst_n) begin
         result_valid <= 0;
     end else if (data_valid) begin
         // Multiply input data with window coefficient
-        multiplied_result <= data_in * window_coeff[window_index];
+        multiplied_result <= data_in * window_coeff[coeff_index];
         result_valid <= 1;
-        
+
         // Update window index
         if (window_index == WINDOW_SIZE - 1) begin
             window_index <= 0;
@@ -45,7 +71,7 @@ always @(posedge clk or negedge rst_n) begin
     end
 end
 
-assign data_out = multiplied_result[DATA_WIDTH*2-1:DATA_WIDTH];
+assign data_out = multiplied_result[DATA_WIDTH+15:16];
 assign data_out_valid = result_valid;
 
 endmodule
@@ -2,7 +2,10 @@ module radar_ip #(
     parameter ADC_WIDTH = 16,
     parameter FFT_SIZE = 1024,
     parameter DOPPLER_SIZE = 64,
-    parameter AXI_DATA_WIDTH = 32
+    parameter AXI_DATA_WIDTH = 32,
+    // Optional $readmemh window tables (see user_app/radar_window), Hamming if empty
+    parameter RANGE_WINDOW_INIT = "",
+    parameter DOPPLER_WINDOW_INIT = ""
 )(
     // Clock and Reset
     input wire clk,
@@ -50,6 +53,14 @@ wire [31:0] prf_reg;
 wire [31:0] pulse_width_reg;
 wire [31:0] range_gate_reg;
 wire [31:0] doppler_bins_reg;
+wire [31:0] window_coeff_reg;
+wire window_coeff_wr;
+
+// Window coefficient upload: WINDOW_COEFF = {table_sel, index[14:0], coeff[15:0]}
+// window_coeff_wr must be a single-cycle strobe per AXI write to WINDOW_COEFF,
+// asserted in the same cycle window_coeff_reg first holds the written value.
+wire range_window_wr = window_coeff_wr && !window_coeff_reg[31];
+wire doppler_window_wr = window_coeff_wr && window_coeff_reg[31];
 
 // DSP Chain signals
 wire [ADC_WIDTH-1:0] range_processed_data;
@@ -89,6 +100,8 @@ radar_control_regs u_control_regs (
     .pulse_width_reg(pulse_width_reg),
     .range_gate_reg(range_gate_reg),
     .doppler_bins_reg(doppler_bins_reg),
+    .window_coeff_reg(window_coeff_reg),
+    .window_coeff_wr(window_coeff_wr),
     .detected_range(detected_range),
     .detected_velocity(detected_velocity),
     .target_detected(target_detected)
@@ -107,7 +120,8 @@ pulse_generator u_pulse_gen (
 // Instantiate range processing (FFT-based matched filter)
 range_processor #(
     .ADC_WIDTH(ADC_WIDTH),
-    .FFT_SIZE(FFT_SIZE)
+    .FFT_SIZE(FFT_SIZE),
+    .WINDOW_INIT(RANGE_WINDOW_INIT)
 ) u_range_proc (
     .clk(clk),
     .rst_n(rst_n),
@@ -115,6 +129,9 @@ range_processor #(
     .rx_data(rx_data),
     .rx_valid(rx_valid),
     .range_gates(range_gate_reg),
+    .window_wr_en(range_window_wr),
+    .window_wr_addr(window_coeff_reg[30:16]),
+    .window_wr_data(window_coeff_reg[15:0]),
     .processed_data(range_processed_data),
     .processed_valid(range_processed_valid)
 );
@@ -135,7 +152,8 @@ mti_filter #(
 // Instantiate Doppler processor
 doppler_processor #(
     .DATA_WIDTH(ADC_WIDTH),
-    .DOPPLER_SIZE(DOPPLER_SIZE)
+    .DOPPLER_SIZE(DOPPLER_SIZE),
+    .WINDOW_INIT(DOPPLER_WINDOW_INIT)
 ) u_doppler_proc (
     .clk(clk),
     .rst_n(rst_n),
@@ -143,6 +161,9 @@ doppler_processor #(
     .data_in(mti_filtered_data),
     .data_valid(mti_filtered_valid),
     .doppler_bins(doppler_bins_reg),
+    .window_wr_en(doppler_window_wr),
+    .window_wr_addr(window_coeff_reg[30:16]),
+    .window_wr_data(window_coeff_reg[15:0]),
     .processed_data(doppler_processed_data),
     .processed_valid(doppler_processed_valid)
 );
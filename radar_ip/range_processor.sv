@@ -1,6 +1,7 @@
 module range_processor #(
     parameter ADC_WIDTH = 16,
-    parameter FFT_SIZE = 1024
+    parameter FFT_SIZE = 1024,
+    parameter WINDOW_INIT = ""
 )(
     input wire clk,
     input wire rst_n,
@@ -8,22 +9,29 @@ module range_processor #(
     input wire [ADC_WIDTH-1:0] rx_data,
     input wire rx_valid,
     input wire [31:0] range_gates,
+    input wire window_wr_en,
+    input wire [14:0] window_wr_addr,
+    input wire [15:0] window_wr_data,
     output wire [ADC_WIDTH-1:0] processed_data,
     output wire processed_valid
 );
 
-// Window function (Hamming window)
+// Window function (Hamming by default, reloadable over AXI-Lite)
 wire [ADC_WIDTH-1:0] windowed_data;
 wire windowed_valid;
 
 hamming_window #(
     .DATA_WIDTH(ADC_WIDTH),
-    .WINDOW_SIZE(FFT_SIZE)
+    .WINDOW_SIZE(FFT_SIZE),
+    .INIT_FILE(WINDOW_INIT)
 ) u_window (
     .clk(clk),
     .rst_n(rst_n),
     .data_in(rx_data),
     .data_valid(rx_valid),
+    .coeff_wr_en(window_wr_en),
+    .coeff_wr_addr(window_wr_addr),
+    .coeff_wr_data(window_wr_data),
     .data_out(windowed_data),
     .data_out_valid(windowed_valid)
 );